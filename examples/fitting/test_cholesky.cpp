@@ -0,0 +1,34 @@
+#include <iostream>
+#include <vector>
+
+#include "matrix.H"
+#include "cholesky.H"
+
+int main() {
+
+    // A^T A for a matrix with independent columns is symmetric
+    // positive definite
+
+    Matrix B{{1.0, 2.0, 0.5},
+             {-1.0, 3.0, 1.0},
+             {0.0, 1.0, 4.0},
+             {2.0, 0.0, 1.0}};
+
+    auto A = gram(B);
+
+    std::cout << "A =\n" << A << std::endl;
+
+    Cholesky chol(A);
+
+    const auto& L = chol.factor();
+    std::cout << "L =\n" << L << std::endl;
+    std::cout << "L L^T =\n" << L * L.view().transposed() << std::endl;
+
+    std::vector<double> x{1.0, -2.0, 3.0};
+    auto b = A * x;
+
+    for (auto e : chol.solve(b)) {
+        std::cout << e << " ";
+    }
+    std::cout << std::endl;
+}
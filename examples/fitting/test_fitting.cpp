@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "fitting.H"
+#include "streaming_fit.H"
 
 
 std::pair<std::vector<double>, std::vector<double>>
@@ -62,4 +63,31 @@ int main() {
     }
     std::cout << std::endl;
 
+    // the same fit, streamed: first the points in memory, then
+    // read back from experiment.dat, 7 points at a time
+
+    StreamingFit fit(M);
+    fit.add(x, y, yerr);
+    auto [a_s, chisq_s] = fit.solve();
+
+    std::cout << "streamed: chisq = " << chisq_s << ", a = ";
+    for (auto e : a_s) {
+        std::cout << e << " ";
+    }
+    std::cout << std::endl;
+
+    of.close();
+    std::ifstream in("experiment.dat");
+
+    StreamingFit file_fit(M);
+    file_fit.add(in, 7);
+    auto [a_f, chisq_f] = file_fit.solve();
+
+    std::cout << "from file (" << file_fit.npoints() << " points): chisq = "
+              << chisq_f << ", a = ";
+    for (auto e : a_f) {
+        std::cout << e << " ";
+    }
+    std::cout << std::endl;
+
 }
@@ -50,4 +50,24 @@ int main() {
         std::cout << e << " ";
     }
     std::cout << std::endl;
+
+    // views: A^T A without copying the transpose, and solving with the
+    // lower-right 3x3 block of a larger matrix, in place
+
+    std::cout << "A^T A (from a view) =\n " << A.view().transposed() * A << std::endl;
+    std::cout << "A^T A (one triangle, mirrored) =\n " << gram(A) << std::endl;
+
+    Matrix big{{9, 9, 9, 9},
+               {9, 1, 4, -2},
+               {9, 9, 12, 3},
+               {9, -1, 3, 8}};
+
+    std::cout << "block =\n" << big.block(1, 1, 3, 3) << std::endl;
+
+    std::vector<double> b_block{0, 18, 19};
+    auto x_block = gauss_elim(big.block(1, 1, 3, 3), b_block);
+    for (auto e : x_block) {
+        std::cout << e << " ";
+    }
+    std::cout << std::endl;
 }
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "array.H"
+#include "lu.H"
+#include "matmul.H"
+
+int main() {
+
+    // this needs pivoting right away
+
+    Array A{{{0, 0, 0, 4},
+             {0, 0, 3, 0},
+             {5, 6, 7, 8},
+             {0, 4, 3, 2}}};
+
+    // factor once...
+
+    LU lu(A);
+
+    std::cout << lu.factors() << std::endl;
+    std::cout << "det(A) = " << lu.determinant() << std::endl << std::endl;
+
+    // ...and reuse the factors for each righthand side
+
+    for (const std::vector<double>& b : {std::vector<double>{5, 4, 9, 1},
+                                         std::vector<double>{1, 0, 0, 0}}) {
+        auto x = lu.solve(b);
+        auto Ax = matmul(A, x);
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            std::cout << x[i] << " (A x = " << Ax[i] << ", b = " << b[i] << ")" << std::endl;
+        }
+        std::cout << std::endl;
+    }
+
+    // all righthand sides at once -- with B = I, X is the inverse
+
+    Array I(4, 4);
+    for (std::size_t i = 0; i < 4; ++i) {
+        I(i, i) = 1.0;
+    }
+
+    auto Ainv = lu.solve(I);
+
+    std::cout << Ainv << std::endl;
+    std::cout << matmul(A, Ainv) << std::endl;
+
+    // the blocked factorization gives the same factors as the
+    // column-at-a-time one (block size 1), for a size that isn't a
+    // multiple of the block size
+
+    const std::size_t N{300};
+    Array B(N, N);
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            B(i, j) = std::sin(static_cast<double>(i * N + j));
+        }
+    }
+
+    LU unblocked(B, 1);
+    LU blocked(B);
+
+    double diff{0.0};
+    for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = 0; j < N; ++j) {
+            diff = std::max(diff, std::abs(blocked.factors()(i, j) - unblocked.factors()(i, j)));
+        }
+    }
+    std::cout << "N = " << N << ", block size " << LU_BLOCK_SIZE
+              << ": max difference from unblocked = " << diff << std::endl;
+}
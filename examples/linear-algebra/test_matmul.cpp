@@ -17,4 +17,18 @@ int main() {
     for (auto element : b) {
         std::cout << element << std::endl;
     }
+
+    // the product with the right 2x2 block of A, without a copy
+
+    std::vector<double> y{1, 2};
+
+    std::cout << A.block(0, 1, 2, 2) << std::endl;
+
+    for (auto element : matmul(A.block(0, 1, 2, 2), y)) {
+        std::cout << element << std::endl;
+    }
+
+    // a matrix-matrix product, A A^T
+
+    std::cout << matmul(A, A.view().transposed()) << std::endl;
 }
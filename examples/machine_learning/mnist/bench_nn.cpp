@@ -0,0 +1,73 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "mnist.H"
+#include "neural_network.H"
+
+// measure the training throughput of the network, with the time
+// spent in each phase of training (see timing.H) written for every
+// epoch as JSON or CSV
+//
+// usage: bench_nn [batch_size [n_threads [mode [format [n_epochs]]]]]
+//
+// where mode is serial, data_parallel, or hogwild and format is json
+// or csv
+
+int main(int argc, char* argv[]) {
+
+    std::size_t batch_size{32};
+    std::size_t n_threads{1};
+    ParallelMode mode{ParallelMode::data_parallel};
+    timing::Format format{timing::Format::json};
+    int n_epochs{3};
+
+    if (argc > 1) {
+        batch_size = std::stoul(argv[1]);
+    }
+    if (argc > 2) {
+        n_threads = std::stoul(argv[2]);
+    }
+    if (argc > 3) {
+        std::string m{argv[3]};
+        if (m == "serial") {
+            n_threads = 1;
+        } else if (m == "data_parallel") {
+            mode = ParallelMode::data_parallel;
+        } else if (m == "hogwild") {
+            mode = ParallelMode::hogwild;
+        } else {
+            std::cout << "Error: unknown mode " << m << std::endl;
+            std::exit(1);
+        }
+    }
+    if (argc > 4) {
+        std::string f{argv[4]};
+        if (f == "json") {
+            format = timing::Format::json;
+        } else if (f == "csv") {
+            format = timing::Format::csv;
+        } else {
+            std::cout << "Error: unknown format " << f << std::endl;
+            std::exit(1);
+        }
+    }
+    if (argc > 5) {
+        n_epochs = std::stoi(argv[5]);
+    }
+
+    auto training_set = mnist::read_compact_training_set();
+    auto test_set = mnist::read_compact_test_set();
+
+    constexpr int hidden_layer_size{50};
+    constexpr double learning_rate{0.1};
+
+    auto n = NeuralNetwork(mnist::DIGIT_ROWS * mnist::DIGIT_COLS,
+                           mnist::DIGIT_CATEGORIES, hidden_layer_size);
+    n.set_threads(n_threads, mode);
+    n.enable_timing(&std::cout, format);
+
+    constexpr bool verbose{false};
+    n.train(training_set, test_set, n_epochs, learning_rate, verbose, batch_size);
+
+}
@@ -0,0 +1,17 @@
+#include <iostream>
+
+#include "mnist_binary.H"
+
+// convert the MNIST CSV files into the binary format described in
+// mnist_binary.H.  This only needs to be done once -- afterwards
+// read_training_set() and read_test_set() will use the binary files.
+
+int main() {
+
+    for (auto [csv_file, binary_file] : {std::pair{"mnist_train.csv", "mnist_train.bin"},
+                                         std::pair{"mnist_test.csv", "mnist_test.bin"}}) {
+        auto n = mnist::convert_csv_to_binary(csv_file, binary_file);
+        std::cout << "converted " << n << " digits from " << csv_file
+                  << " to " << binary_file << std::endl;
+    }
+}
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "activations.H"
+#include "matrix.H"
+
+// check the accuracy of fast_exp and FastSigmoid against the
+// standard library, and time applying the activations to a matrix
+
+template <typename Act>
+double time_apply(Matrix& Z) {
+    auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < 20; ++n) {
+        Z.apply_inplace(activation::value_of<Act>{});
+        Z.apply_inplace([] (double z) { return 8.0 * z - 4.0; });
+    }
+    std::chrono::duration<double> dt = std::chrono::steady_clock::now() - start;
+    return dt.count();
+}
+
+int main() {
+
+    // relative error of fast_exp over its full range
+
+    double max_rel_err{0.0};
+    constexpr int npts{2000001};
+    for (int n = 0; n < npts; ++n) {
+        double x = -708.0 + 1416.0 * n / (npts - 1);
+        double e = std::exp(x);
+        max_rel_err = std::max(max_rel_err, std::abs(activation::fast_exp(x) - e) / e);
+    }
+    std::cout << "fast_exp: max relative error = " << max_rel_err
+              << " (bound " << activation::FAST_EXP_MAX_REL_ERROR << ")" << std::endl;
+
+    // absolute error of the sigmoid
+
+    double max_sig_err{0.0};
+    for (int n = 0; n < npts; ++n) {
+        double x = -50.0 + 100.0 * n / (npts - 1);
+        max_sig_err = std::max(max_sig_err,
+                               std::abs(activation::FastSigmoid::value(x) -
+                                        activation::Sigmoid::value(x)));
+    }
+    std::cout << "FastSigmoid: max absolute error = " << max_sig_err << std::endl;
+
+    if (max_rel_err > activation::FAST_EXP_MAX_REL_ERROR ||
+        max_sig_err > activation::FAST_EXP_MAX_REL_ERROR) {
+        std::cout << "Error: fast_exp is not accurate enough" << std::endl;
+        return 1;
+    }
+
+    // timing -- the same sized matrix as the hidden layer for a
+    // batch of 256 digits with 512 hidden nodes
+
+    Matrix Z(512, 256, 0.5);
+    std::cout << "Sigmoid:     " << time_apply<activation::Sigmoid>(Z) << " s" << std::endl;
+    Z = Matrix(512, 256, 0.5);
+    std::cout << "FastSigmoid: " << time_apply<activation::FastSigmoid>(Z) << " s" << std::endl;
+    Z = Matrix(512, 256, 0.5);
+    std::cout << "ReLU:        " << time_apply<activation::ReLU>(Z) << " s" << std::endl;
+}
@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+
+#include "gemm.H"
+#include "matrix.H"
+
+// compare the blocked matrix-matrix product to the reference triple
+// loop for each of the kernels this CPU supports, in double and
+// float, and time them.  A * B splits large products across the
+// shared thread pool, so the speedup over a single thread is timed
+// too.
+
+template <typename T>
+BasicMatrix<T> random_matrix(std::size_t rows, std::size_t cols, std::mt19937& generator) {
+    std::uniform_real_distribution<T> r(-1.0, 1.0);
+    BasicMatrix<T> A(rows, cols);
+    std::generate(A.flat().begin(), A.flat().end(),
+                  [&]() -> T {return r(generator);});
+    return A;
+}
+
+template <typename T>
+double max_diff(BasicMatrix<T>& A, BasicMatrix<T>& B) {
+    double err{0.0};
+    for (std::size_t n = 0; n < A.flat().size(); ++n) {
+        err = std::max(err, static_cast<double>(std::abs(A.flat()[n] - B.flat()[n])));
+    }
+    return err;
+}
+
+template <typename T>
+double max_abs(BasicMatrix<T>& A) {
+    double a{0.0};
+    for (auto e : A.flat()) {
+        a = std::max(a, static_cast<double>(std::abs(e)));
+    }
+    return a;
+}
+
+// check odd sizes that don't fit evenly into the tiles or blocks.
+// Both products round each of the k terms of a sum, so they can
+// differ by about k eps max|A| max|B| -- we allow twice that.
+// Returns false if any kernel is off by more.
+
+template <typename T>
+bool check(const std::vector<gemm::Isa>& isas, const std::string& type_name,
+           std::mt19937& generator) {
+
+    constexpr double eps = std::numeric_limits<T>::epsilon();
+
+    bool ok{true};
+    for (auto isa : isas) {
+        gemm::set_isa(isa);
+        double err{0.0};
+        for (auto [m, n, k] : {std::tuple{1, 1, 1}, {10, 1, 50}, {50, 1, 784},
+                               {10, 50, 1}, {7, 9, 13}, {50, 32, 784},
+                               {150, 257, 300}, {300, 4100, 20}}) {
+            auto A = random_matrix<T>(m, k, generator);
+            auto B = random_matrix<T>(k, n, generator);
+            auto C = A * B;
+            auto C_ref = A.multiply_reference(B);
+            const double diff = max_diff(C, C_ref);
+            const double tol = 2.0 * k * eps * max_abs(A) * max_abs(B);
+            if (diff > tol) {
+                std::cout << "Error: " << gemm::active_kernel<T>().name << " kernel ("
+                          << type_name << ") is off by " << diff << " for m = " << m
+                          << ", n = " << n << ", k = " << k << " (tolerance "
+                          << tol << ")" << std::endl;
+                ok = false;
+            }
+            err = std::max(err, diff);
+        }
+        std::cout << gemm::active_kernel<T>().name << " kernel (" << type_name
+                  << "): max error = " << err << std::endl;
+    }
+    return ok;
+}
+
+// time the N x N product with each kernel
+
+template <typename T>
+void time_kernels(const std::vector<gemm::Isa>& isas, std::size_t N,
+                  std::mt19937& generator) {
+
+    auto A = random_matrix<T>(N, N, generator);
+    auto B = random_matrix<T>(N, N, generator);
+    const double flops = 2.0 * static_cast<double>(N * N * N);
+
+    for (auto isa : isas) {
+        gemm::set_isa(isa);
+        auto start = std::chrono::steady_clock::now();
+        auto C = A * B;
+        std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+        std::cout << ", " << gemm::active_kernel<T>().name << " "
+                  << flops / t.count() * 1.e-9 << " GFLOPS";
+    }
+}
+
+int main() {
+
+    std::mt19937 generator(12345);
+
+    std::vector<gemm::Isa> isas{gemm::Isa::generic};
+    if (gemm::detect_isa() >= gemm::Isa::avx2) {
+        isas.push_back(gemm::Isa::avx2);
+    }
+    if (gemm::detect_isa() >= gemm::Isa::avx512) {
+        isas.push_back(gemm::Isa::avx512);
+    }
+
+    bool ok = check<double>(isas, "double", generator);
+    ok = check<float>(isas, "float", generator) && ok;
+
+    // timing
+
+    for (std::size_t N : {256, 512, 1024}) {
+        auto A = random_matrix<double>(N, N, generator);
+        auto B = random_matrix<double>(N, N, generator);
+        const double flops = 2.0 * static_cast<double>(N * N * N);
+
+        auto start = std::chrono::steady_clock::now();
+        auto C_ref = A.multiply_reference(B);
+        std::chrono::duration<double> t_ref = std::chrono::steady_clock::now() - start;
+        std::cout << "N = " << N << ": reference " << flops / t_ref.count() * 1.e-9 << " GFLOPS";
+
+        time_kernels<double>(isas, N, generator);
+        std::cout << std::endl;
+
+        std::cout << "  float";
+        time_kernels<float>(isas, N, generator);
+        std::cout << std::endl;
+    }
+
+    // one thread vs. all of them, with the fastest kernel
+
+    gemm::set_isa(isas.back());
+    for (std::size_t N : {256, 512, 1024}) {
+        auto A = random_matrix<double>(N, N, generator);
+        auto B = random_matrix<double>(N, N, generator);
+        BasicMatrix<double> C(N, N);
+        const double flops = 2.0 * static_cast<double>(N * N * N);
+
+        auto start = std::chrono::steady_clock::now();
+        gemm::multiply(N, N, N, A.data(), N, 1, B.data(), N, 1, C.data(), N, 1);
+        std::chrono::duration<double> t_serial = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        gemm::parallel_multiply(N, N, N, A.data(), N, 1, B.data(), N, 1, C.data(), N, 1);
+        std::chrono::duration<double> t_parallel = std::chrono::steady_clock::now() - start;
+
+        std::cout << "N = " << N << ": 1 thread " << flops / t_serial.count() * 1.e-9
+                  << " GFLOPS, " << shared_pool().size() << " threads "
+                  << flops / t_parallel.count() * 1.e-9 << " GFLOPS" << std::endl;
+    }
+
+    return ok ? 0 : 1;
+}
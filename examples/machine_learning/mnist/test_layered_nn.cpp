@@ -0,0 +1,54 @@
+#include <iostream>
+
+#include "layered_network.H"
+#include "mnist.H"
+
+
+int main() {
+
+    // train a network with two hidden layers
+
+    std::cout << "reading in the data...";
+
+    auto training_set = mnist::read_compact_training_set();
+    auto test_set = mnist::read_compact_test_set();
+
+    std::cout << "done\n" << std::endl;
+
+    constexpr int n_epochs{10};
+    constexpr double learning_rate{0.5};
+    constexpr std::size_t batch_size{16};
+
+    LayeredNetwork n(mnist::DIGIT_ROWS * mnist::DIGIT_COLS);
+    n.add_layer(100, activation::Kind::relu)
+     .add_layer(50, activation::Kind::sigmoid)
+     .add_layer(mnist::DIGIT_CATEGORIES, activation::Kind::sigmoid);
+
+    n.train(training_set, test_set, n_epochs, learning_rate, true, batch_size);
+
+    // now assess how well we did using the test set
+
+    auto score = n.evaluate(test_set);
+
+    std::cout << "finished training!" << std::endl;
+    std::cout << "final test set accuracy = " << score.accuracy()
+              << std::endl << std::endl;
+    std::cout << "confusion matrix:\n" << score << std::endl;
+
+    std::cout << "Exploring the number of hidden layers:" << std::endl;
+
+    for (int n_hidden : {1, 2, 3}) {
+        LayeredNetwork m(mnist::DIGIT_ROWS * mnist::DIGIT_COLS);
+        for (int l = 0; l < n_hidden; ++l) {
+            m.add_layer(50, activation::Kind::sigmoid);
+        }
+        m.add_layer(mnist::DIGIT_CATEGORIES, activation::Kind::sigmoid);
+
+        constexpr bool verbose{false};
+        m.train(training_set, test_set, n_epochs, learning_rate, verbose, batch_size);
+
+        std::cout << "hidden layers = " << n_hidden
+                  << " accuracy = " << m.evaluate(test_set).accuracy()
+                  << std::endl;
+    }
+}
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <vector>
 
+#include "arena.H"
 #include "matrix.H"
 
 
@@ -18,6 +19,15 @@ int main() {
 
     std::cout << A.transpose() * b << std::endl;
 
+    // the same, without forming the transpose
+    std::cout << A.transpose_multiply(b) << std::endl;
+
+    // rank-1 update, A += 2 b x^T
+    Matrix xm{{0}, {1}, {2}};
+    Matrix D = A;
+    D.add_outer(2.0, b, xm);
+    std::cout << D << std::endl;
+
     Matrix B{{1, 2}, {3, 4}};
 
     B.apply_inplace([](double x) -> double {return 2*x+1;});
@@ -34,4 +44,23 @@ int main() {
 
     std::cout << P + Q << std::endl;
     std::cout << P - Q << std::endl;
+
+    // P Q^T, with the transpose as a view, and the product of a block
+    Matrix PQt(2, 2);
+    multiply_into(P.view(), Q.view().transposed(), PQt.view());
+    std::cout << PQt << std::endl;
+
+    Matrix Ab(2, 1);
+    multiply_into(A.block(1, 1, 2, 2), Matrix{{1}, {2}}.view(), Ab.view());
+    std::cout << Ab << std::endl;
+
+    // temporaries from the arena, released at the end of the scope
+    {
+        arena::Scope scope;
+        using Scratch = BasicMatrix<double, arena::Allocator<double>>;
+        Scratch R(2, 4);
+        P.multiply_into(A.transpose(), R);
+        Scratch S = R % R;
+        std::cout << S << std::endl;
+    }
 }
@@ -25,19 +25,12 @@ int main() {
 
     // now assess how well we did using the test set
 
-    int n_correct{0};
-    for (auto model : test_set) {
-        auto res = n.predict(model);
-        if (model.validate(res)) {
-            n_correct += 1;
-        }
-    }
+    auto score = n.evaluate(test_set);
 
     std::cout << "finished training!" << std::endl;
-    std::cout << "final test set accuracy = "
-              << static_cast<double>(n_correct) /
-                 static_cast<double>(test_set.size())
+    std::cout << "final test set accuracy = " << score.accuracy()
               << std::endl << std::endl;
+    std::cout << "confusion matrix:\n" << score << std::endl;
 
 #if 0
     // output the first 10 we get wrong
@@ -69,18 +62,8 @@ int main() {
 
         // now assess how well we did using the test set
 
-        int n_correct{0};
-        for (auto model : test_set) {
-            auto res = n.predict(model);
-            if (model.validate(res)) {
-                n_correct += 1;
-            }
-        }
-
         std::cout << "hidden layer size = " << hl_size
-                  << " accuracy = "
-                  << static_cast<double>(n_correct) /
-                     static_cast<double>(test_set.size())
+                  << " accuracy = " << n.evaluate(test_set).accuracy()
                   << std::endl;
     }
 
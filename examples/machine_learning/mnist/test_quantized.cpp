@@ -0,0 +1,85 @@
+#include <chrono>
+#include <iostream>
+
+#include "mnist.H"
+#include "neural_network.H"
+#include "quantized_network.H"
+
+// train a network, quantize it to int8, and compare the two, both in
+// accuracy and speed.  Returns false if the digit-at-a-time results
+// don't agree with compare() and evaluate().
+
+template <typename Net, typename Digits>
+bool report(Net& n, const Digits& test_set) {
+
+    QuantizedNetwork q(n);
+
+    const auto comparison = compare(n, q, test_set);
+    std::cout << comparison;
+
+    // time the inference one digit at a time
+
+    std::size_t n_correct{0};
+    std::size_t n_q_correct{0};
+
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& digit : test_set) {
+        n_correct += digit.validate(n.predict(digit));
+    }
+    std::chrono::duration<double> t_double = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (const auto& digit : test_set) {
+        n_q_correct += q.classify(digit.pixels) == digit.num;
+    }
+    std::chrono::duration<double> t_int8 = std::chrono::steady_clock::now() - start;
+
+    const auto N = static_cast<double>(test_set.size());
+    std::cout << "  time per digit: double = " << t_double.count() / N * 1.e6 << " us"
+              << ", int8 = " << t_int8.count() / N * 1.e6 << " us" << std::endl;
+
+    bool ok{true};
+
+    const auto n_expected = static_cast<std::size_t>(N * comparison.accuracy + 0.5);
+    if (n_correct != n_expected) {
+        std::cout << "Error: " << n_correct << " digits correct one at a time, but compare() found "
+                  << n_expected << std::endl;
+        ok = false;
+    }
+
+    const auto n_q_expected = q.evaluate(test_set).n_correct;
+    if (n_q_correct != n_q_expected) {
+        std::cout << "Error: " << n_q_correct << " digits correct with classify(), but evaluate() found "
+                  << n_q_expected << std::endl;
+        ok = false;
+    }
+
+    return ok;
+}
+
+int main() {
+
+    std::cout << "reading in the data...";
+
+    auto training_set = mnist::read_compact_training_set();
+    auto test_set = mnist::read_compact_test_set();
+
+    std::cout << "done\n" << std::endl;
+
+    constexpr int hidden_layer_size{100};
+    constexpr int n_epochs{5};
+
+    std::cout << "sigmoid network:" << std::endl;
+    NeuralNetwork n(mnist::DIGIT_ROWS * mnist::DIGIT_COLS,
+                    mnist::DIGIT_CATEGORIES, hidden_layer_size);
+    n.train(training_set, test_set, n_epochs, 0.1, false);
+    bool ok = report(n, test_set);
+
+    std::cout << "ReLU network:" << std::endl;
+    BasicNeuralNetwork<activation::ReLU> r(mnist::DIGIT_ROWS * mnist::DIGIT_COLS,
+                                           mnist::DIGIT_CATEGORIES, hidden_layer_size);
+    r.train(training_set, test_set, n_epochs, 0.01, false);
+    ok = report(r, test_set) && ok;
+
+    return ok ? 0 : 1;
+}
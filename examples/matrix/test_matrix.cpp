@@ -21,6 +21,19 @@ int main() {
 
     std::cout << "A + B =\n" << A + B << std::endl;
 
+    // a chain of operations -- only the first allocates, the rest
+    // reuse its storage
+
+    std::cout << "(A * 2 + B - C) / 4 =\n" << (A * 2 + B - C) / 4 << std::endl;
+
+    // in place
+
+    Matrix D(A);
+    D *= 3;
+    D -= B;
+    D /= 2;
+    std::cout << "D = (3 A - B) / 2 =\n" << D << std::endl;
+
     Matrix K{{{1}, {2}, {3}, {4}}};
     Matrix M{{{1, 2, 3, 4}}};
 
@@ -33,4 +46,17 @@ int main() {
     // square each element
     std::cout << "squaring the elements of A:\n" << A.transform([] (double x) {return x*x;}) << std::endl;
 
+    // the same product with the rows padded to whole cache lines
+
+    Matrix Kp(4, 1, 0.0, true);
+    Matrix Mp(1, 4, 0.0, true);
+    for (int i = 0; i < 4; ++i) {
+        Kp(i, 0) = K(i, 0);
+        Mp(0, i) = M(0, i);
+    }
+
+    std::cout << "padded row stride for 4 columns = " << Mp.stride() << std::endl;
+    std::cout << "padded K * M =\n" << Kp * Mp << std::endl;
+    std::cout << "padded K * M squared =\n" << (Kp * Mp).transform([] (double x) {return x*x;}) << std::endl;
+
 }